@@ -0,0 +1,142 @@
+#include <cassert>
+#include <memory>
+#include <algorithm>
+#include <stdexcept>
+
+#include <ProtoReflection/H/Pipeline.h>
+
+namespace easy {
+    // Inputs claimed per counter increment. Small enough to balance uneven messages, large enough to limit contention.
+    static constexpr size_t KClaimSize = 4;
+
+    Pipeline::Pipeline(const google::protobuf::Message* prototype, unsigned workers)
+    {
+        assert(prototype);
+
+        if (not workers)
+            workers = std::max(1u, std::thread::hardware_concurrency());
+
+        for (unsigned i = 0; i < workers; ++i) {
+            messages_.emplace_back(prototype->New());
+        }
+
+        try {
+            for (auto& message : messages_) {
+                threads_.emplace_back(&Pipeline::Work, this, message.get());
+            }
+        }
+        catch (...) {
+            Stop();
+            throw;
+        }
+    }
+
+    Pipeline::~Pipeline()
+    {
+        Stop();
+    }
+
+    void Pipeline::Stop()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stop_ = true;
+        }
+        start_.notify_all();
+
+        for (auto& thread : threads_) {
+            thread.join();
+        }
+    }
+
+    Pipeline& Pipeline::Then(Transform transform)
+    {
+        assert(transform);
+        transforms_.push_back(std::move(transform));
+        return *this;
+    }
+
+    std::vector<std::string> Pipeline::Run(const std::vector<std::string>& inputs)
+    {
+        std::lock_guard<std::mutex> run_lock(run_mutex_);
+
+        std::vector<std::string> outputs(inputs.size());
+        if (inputs.empty())
+            return outputs;
+
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            inputs_ = &inputs;
+            outputs_ = &outputs;
+            next_ = 0;
+            error_ = nullptr;
+            busy_ = threads_.size();
+            ++generation_;
+        }
+        start_.notify_all();
+
+        std::unique_lock<std::mutex> lock(mutex_);
+        done_.wait(lock, [&]() { return busy_ == 0; });
+
+        inputs_ = nullptr;
+        outputs_ = nullptr;
+
+        if (error_)
+            std::rethrow_exception(error_);
+
+        return outputs;
+    }
+
+    void Pipeline::Work(google::protobuf::Message* message)
+    {
+        Reflection reflection(message);
+
+        size_t generation = 0;
+        while (true) {
+            {
+                std::unique_lock<std::mutex> lock(mutex_);
+                start_.wait(lock, [&]() { return stop_ or generation_ != generation; });
+                if (stop_)
+                    return;
+                generation = generation_;
+            }
+
+            Process(*message, reflection);
+
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (--busy_ == 0)
+                done_.notify_one();
+        }
+    }
+
+    void Pipeline::Process(google::protobuf::Message& message, Reflection& reflection)
+    {
+        const auto& inputs = *inputs_;
+        auto& outputs = *outputs_;
+
+        for (size_t begin = next_.fetch_add(KClaimSize); begin < inputs.size(); begin = next_.fetch_add(KClaimSize)) {
+            const size_t end = std::min(begin + KClaimSize, inputs.size());
+
+            try {
+                for (size_t i = begin; i < end; ++i) {
+                    if (not message.ParseFromString(inputs[i]))
+                        throw std::invalid_argument("Pipeline input " + std::to_string(i) + " could not be parsed");
+
+                    for (const auto& transform : transforms_) {
+                        transform(reflection);
+                    }
+
+                    if (not message.SerializeToString(&outputs[i]))
+                        throw std::runtime_error("Pipeline output " + std::to_string(i) + " could not be serialized");
+                }
+            }
+            catch (...) {
+                std::lock_guard<std::mutex> lock(mutex_);
+                if (not error_)
+                    error_ = std::current_exception();
+                next_ = inputs.size();
+                return;
+            }
+        }
+    }
+}
@@ -1,3 +1,5 @@
+#include <typeinfo>
+
 #include <ProtoReflection/H/Reflection.h>
 
 namespace easy {
@@ -25,4 +27,25 @@ namespace easy {
 
         return TypeWrapper(message_, field_descriptor);
     }
+
+    TypeWrapper Reflection::At(const SchemaIndex::Path& path)
+    {
+        if (path.empty() or path.front()->containing_type() != message_->GetDescriptor())
+            throw std::bad_typeid();
+
+        google::protobuf::Message* message = message_;
+        for (auto it = path.begin(); it + 1 != path.end(); ++it) {
+            message = message->GetReflection()->MutableMessage(message, *it);
+        }
+
+        return TypeWrapper(message, path.back());
+    }
+
+    TypeWrapper Reflection::At(const SchemaIndex& index, const std::string& path)
+    {
+        if (not index.Contains(message_->GetDescriptor()))
+            throw std::bad_typeid();
+
+        return At(index.Find(message_->GetDescriptor(), path));
+    }
 }
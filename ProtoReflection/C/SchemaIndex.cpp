@@ -0,0 +1,96 @@
+#include <cassert>
+#include <stdexcept>
+
+#include <ProtoReflection/H/SchemaIndex.h>
+
+namespace easy {
+    SchemaIndex::SchemaIndex(const google::protobuf::Descriptor* descriptor)
+        : root_(descriptor)
+    {
+        assert(root_);
+        Index(root_);
+    }
+
+    const google::protobuf::Descriptor* SchemaIndex::Root() const
+    {
+        return root_;
+    }
+
+    bool SchemaIndex::Contains(const google::protobuf::Descriptor* descriptor) const
+    {
+        return fields_.find(descriptor) != fields_.end();
+    }
+
+    bool SchemaIndex::Contains(const std::string& path) const
+    {
+        return Contains(root_, path);
+    }
+
+    bool SchemaIndex::Contains(const google::protobuf::Descriptor* descriptor, const std::string& path) const
+    {
+        Path chain;
+        return Resolve(descriptor, path, chain);
+    }
+
+    SchemaIndex::Path SchemaIndex::Find(const std::string& path) const
+    {
+        return Find(root_, path);
+    }
+
+    SchemaIndex::Path SchemaIndex::Find(const google::protobuf::Descriptor* descriptor, const std::string& path) const
+    {
+        if (not Contains(descriptor))
+            throw std::out_of_range("Message type is not part of the index of " + root_->full_name());
+
+        Path chain;
+        if (not Resolve(descriptor, path, chain))
+            throw std::out_of_range("Path " + path + " does not resolve in " + descriptor->full_name());
+
+        return chain;
+    }
+
+    void SchemaIndex::Index(const google::protobuf::Descriptor* descriptor)
+    {
+        auto [it, inserted] = fields_.try_emplace(descriptor);
+        if (not inserted)
+            return;
+
+        // Recursion may rehash fields_, references stay valid while iterators do not.
+        auto& fields = it->second;
+
+        for (int i = 0; i < descriptor->field_count(); ++i) {
+            const auto* field_descriptor = descriptor->field(i);
+            fields.emplace(field_descriptor->name(), field_descriptor);
+
+            if (field_descriptor->message_type())
+                Index(field_descriptor->message_type());
+        }
+    }
+
+    bool SchemaIndex::Resolve(const google::protobuf::Descriptor* descriptor, const std::string& path, Path& chain) const
+    {
+        size_t begin = 0;
+        while (descriptor) {
+            const auto fields = fields_.find(descriptor);
+            if (fields == fields_.end())
+                return false;
+
+            const size_t end = path.find('.', begin);
+            const auto field = fields->second.find(path.substr(begin, end - begin));
+            if (field == fields->second.end())
+                return false;
+
+            chain.push_back(field->second);
+            if (end == std::string::npos)
+                return true;
+
+            if (field->second->is_repeated())
+                return false;
+
+            descriptor = field->second->message_type();
+            begin = end + 1;
+        }
+
+        return false;
+    }
+}
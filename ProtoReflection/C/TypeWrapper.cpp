@@ -1,6 +1,8 @@
 #include <set>
+#include <typeinfo>
 
 #include <ProtoReflection/H/TypeWrapper.h>
+#include <ProtoReflection/H/Reflection.h>
 
 
 namespace easy {
@@ -224,4 +226,21 @@ namespace easy {
             : TypeWrapper(message_, field_descriptor);
     }
 
+    TypeWrapper TypeWrapper::At(const SchemaIndex::Path& path)
+    {
+        if (descriptor_->type() != google::protobuf::FieldDescriptor::Type::TYPE_MESSAGE or descriptor_->is_repeated())
+            throw std::bad_typeid();
+
+        return Reflection(reflection_->MutableMessage(message_, descriptor_)).At(path);
+    }
+
+    TypeWrapper TypeWrapper::At(const SchemaIndex& index, const std::string& path)
+    {
+        if (descriptor_->type() != google::protobuf::FieldDescriptor::Type::TYPE_MESSAGE or descriptor_->is_repeated())
+            throw std::bad_typeid();
+        if (not index.Contains(descriptor_->message_type()))
+            throw std::bad_typeid();
+
+        return At(index.Find(descriptor_->message_type(), path));
+    }
 }
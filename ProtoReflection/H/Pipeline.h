@@ -0,0 +1,81 @@
+#pragma once
+
+#include <mutex>
+#include <memory>
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+#include <exception>
+#include <functional>
+#include <condition_variable>
+
+#include <google/protobuf/message.h>
+
+#include <ProtoReflection/H/Reflection.h>
+
+#include <ProtoReflection_api.h>
+
+namespace easy {
+    /**
+     * Parses, transforms and serializes batches of messages on a persistent pool of worker threads.
+     * Each worker owns one message of the prototype's type and reuses it for every input it processes.
+     *
+     * This is a batch API. Streaming input, back-pressure, overlap between the parse, transform and serialize
+     * stages, and unordered output are not supported.
+     */
+    class PROTOREFLECTION_EXPORT Pipeline {
+    public:
+        /**
+         * Transforms run concurrently on all workers, so they must be safe to call from several threads at once.
+         * Mutable captured state such as counters or caches needs its own synchronization.
+         */
+        using Transform = std::function<void(Reflection&)>;
+
+        /**
+         * Starts the worker threads for messages of the prototype's type.
+         * A workers value of 0 uses one worker per hardware thread.
+         * The prototype is only used during construction, where each worker's message is allocated.
+         */
+        Pipeline(const google::protobuf::Message* prototype, unsigned workers = 0);
+        Pipeline(const Pipeline&) = delete;
+        Pipeline& operator=(const Pipeline&) = delete;
+        ~Pipeline();
+
+        /**
+         * Appends a transform. Transforms run in insertion order on every message.
+         * Must not be called while Run is in progress.
+         */
+        Pipeline& Then(Transform transform);
+
+        /**
+         * Processes one batch and blocks until it is done. Workers claim small runs of inputs from a shared
+         * counter, so uneven message costs do not leave threads idle. The outputs keep the order of the inputs.
+         * Concurrent calls are serialized. Throws std::invalid_argument if an input does not parse and
+         * std::runtime_error if a message does not serialize.
+         */
+        std::vector<std::string> Run(const std::vector<std::string>& inputs);
+
+    private:
+        void Stop();
+        void Work(google::protobuf::Message* message);
+        void Process(google::protobuf::Message& message, Reflection& reflection);
+
+        std::vector<Transform> transforms_;
+        std::vector<std::unique_ptr<google::protobuf::Message>> messages_;
+        std::vector<std::thread> threads_;
+
+        std::mutex run_mutex_;
+        std::mutex mutex_;
+        std::condition_variable start_;
+        std::condition_variable done_;
+        size_t generation_ = 0;
+        size_t busy_ = 0;
+        bool stop_ = false;
+
+        const std::vector<std::string>* inputs_ = nullptr;
+        std::vector<std::string>* outputs_ = nullptr;
+        std::atomic<size_t> next_{ 0 };
+        std::exception_ptr error_;
+    };
+}
@@ -3,6 +3,7 @@
 #include <google/protobuf/message.h>
 
 #include <ProtoReflection/H/TypeWrapper.h>
+#include <ProtoReflection/H/SchemaIndex.h>
 
 #include <ProtoReflection_api.h>
 
@@ -15,6 +16,20 @@ namespace easy {
 
         TypeWrapper At(const std::string& id);
 
+        /**
+         * Walks a chain of fields resolved up front with SchemaIndex::Find, without any string lookups.
+         * Throws std::bad_typeid if the chain is empty or does not start at the wrapped message type.
+         * Intermediate submessages are reached with MutableMessage, so even a read creates the missing
+         * submessages on the path and marks them as present.
+         */
+        TypeWrapper At(const SchemaIndex::Path& path);
+
+        /**
+         * Resolves a dotted path ("embedded.str") through the index on every call, then walks it like At(path).
+         * Throws std::bad_typeid if the index does not cover the wrapped message type.
+         */
+        TypeWrapper At(const SchemaIndex& index, const std::string& path);
+
     private:
         google::protobuf::Message* message_;
     };
@@ -0,0 +1,46 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <unordered_map>
+
+#include <google/protobuf/descriptor.h>
+
+#include <ProtoReflection_api.h>
+
+namespace easy {
+    /**
+     * In-memory field lookup tables for every message type reachable from a root descriptor.
+     * Each type is indexed once, so the cost is linear in the size of the schema. The index is not
+     * persisted, so it does not shorten a cold start. It is immutable once built and safe to share between threads.
+     */
+    class PROTOREFLECTION_EXPORT SchemaIndex {
+    public:
+        using Path = std::vector<const google::protobuf::FieldDescriptor*>;
+
+        explicit SchemaIndex(const google::protobuf::Descriptor* descriptor);
+
+        const google::protobuf::Descriptor* Root() const;
+        bool Contains(const google::protobuf::Descriptor* descriptor) const;
+        bool Contains(const std::string& path) const;
+        bool Contains(const google::protobuf::Descriptor* descriptor, const std::string& path) const;
+
+        /**
+         * Returns the chain of fields for a dotted path ("embedded.str") starting at the root or at the given descriptor.
+         * Paths through recursive types have no depth limit. Throws std::out_of_range if the descriptor is not indexed,
+         * or if the path does not resolve or crosses a repeated field.
+         * Resolve each path once and pass the result to Reflection::At or TypeWrapper::At to skip the string work.
+         */
+        Path Find(const std::string& path) const;
+        Path Find(const google::protobuf::Descriptor* descriptor, const std::string& path) const;
+
+    private:
+        using Fields = std::unordered_map<std::string, const google::protobuf::FieldDescriptor*>;
+
+        void Index(const google::protobuf::Descriptor* descriptor);
+        bool Resolve(const google::protobuf::Descriptor* descriptor, const std::string& path, Path& chain) const;
+
+        const google::protobuf::Descriptor* root_;
+        std::unordered_map<const google::protobuf::Descriptor*, Fields> fields_;
+    };
+}
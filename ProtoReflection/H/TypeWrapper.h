@@ -7,6 +7,8 @@
 #include <google/protobuf/reflection.h>
 #include <google/protobuf/repeated_field.h>
 
+#include <ProtoReflection/H/SchemaIndex.h>
+
 #include <ProtoReflection_api.h>
 
 namespace easy {
@@ -73,6 +75,17 @@ namespace easy {
          */
         TypeWrapper At(const std::string& id);
 
+        /**
+         * Walks a chain of fields resolved up front with SchemaIndex::Find, relative to this message field.
+         * Like Reflection::At, it creates the missing submessages on the path, this field included.
+         */
+        TypeWrapper At(const SchemaIndex::Path& path);
+
+        /**
+         * Resolves a dotted path relative to this message field through the index on every call, then walks it like At(path).
+         */
+        TypeWrapper At(const SchemaIndex& index, const std::string& path);
+
     private:
         google::protobuf::Message* message_;
         const google::protobuf::FieldDescriptor* descriptor_;
@@ -0,0 +1,185 @@
+#include <mutex>
+#include <chrono>
+#include <algorithm>
+#include <stdexcept>
+#include <condition_variable>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <protos/simple.pb.h>
+
+#include <ProtoReflection/H/Pipeline.h>
+
+static std::vector<std::string> MakeInputs(size_t count)
+{
+    std::vector<std::string> inputs;
+    for (size_t i = 0; i < count; ++i) {
+        Simple simple;
+        simple.set_int_(static_cast<int32_t>(i));
+        simple.mutable_embedded()->set_str("input");
+        inputs.push_back(simple.SerializeAsString());
+    }
+    return inputs;
+}
+
+static void Double(easy::Reflection& reflection)
+{
+    int32_t value = reflection.At("int");
+    reflection.At("int") = value * 2;
+}
+
+static void RequireDoubled(const std::vector<std::string>& outputs, size_t count)
+{
+    CHECK(outputs.size() == count);
+
+    for (size_t i = 0; i < outputs.size(); ++i) {
+        Simple simple;
+        CHECK(simple.ParseFromString(outputs[i]));
+        REQUIRE(simple.int_() == static_cast<int32_t>(i * 2));
+    }
+}
+
+TEST_CASE("Pipeline applies transforms in order", "[Pipeline]") {
+
+    Simple prototype;
+    easy::SchemaIndex index(Simple::descriptor());
+    const auto embedded_str = index.Find("embedded.str");
+
+    easy::Pipeline pipeline(&prototype, 4);
+    pipeline
+        .Then(Double)
+        .Then([](easy::Reflection& reflection) {
+            int32_t value = reflection.At("int");
+            reflection.At("int") = value + 1;
+        })
+        .Then([&](easy::Reflection& reflection) {
+            reflection.At(embedded_str) = std::string("output");
+        });
+
+    SECTION("Outputs keep the input order") {
+        auto outputs = pipeline.Run(MakeInputs(103));
+        CHECK(outputs.size() == 103);
+
+        for (size_t i = 0; i < outputs.size(); ++i) {
+            Simple simple;
+            CHECK(simple.ParseFromString(outputs[i]));
+            CHECK(simple.int_() == static_cast<int32_t>(i * 2 + 1));
+            REQUIRE(simple.embedded().str() == "output");
+        }
+    }
+
+    SECTION("Workers are reused between runs") {
+        for (size_t i = 0; i < 10; ++i) {
+            CHECK(pipeline.Run(MakeInputs(i)).size() == i);
+        }
+        REQUIRE(pipeline.Run(MakeInputs(10)).size() == 10);
+    }
+
+    SECTION("Empty batch") {
+        REQUIRE(pipeline.Run({}).empty());
+    }
+
+    SECTION("Invalid input") {
+        auto inputs = MakeInputs(10);
+        inputs[7] = "\xff";
+        auto e = [&]() { pipeline.Run(inputs); };
+        REQUIRE_THROWS_AS(e(), std::invalid_argument);
+    }
+}
+
+TEST_CASE("Pipeline forwards transform exceptions", "[Pipeline]") {
+
+    Simple prototype;
+    easy::Pipeline pipeline(&prototype, 4);
+    pipeline.Then([](easy::Reflection& reflection) {
+        int32_t value = reflection.At("int");
+        if (value == 37)
+            throw std::logic_error("transform failed");
+    });
+
+    auto e = [&]() { pipeline.Run(MakeInputs(100)); };
+    REQUIRE_THROWS_AS(e(), std::logic_error);
+
+    SECTION("Pipeline is usable afterwards") {
+        REQUIRE(pipeline.Run(MakeInputs(10)).size() == 10);
+    }
+}
+
+TEST_CASE("Pipeline worker counts", "[Pipeline]") {
+
+    Simple prototype;
+
+    SECTION("Default uses the hardware threads") {
+        easy::Pipeline pipeline(&prototype);
+        pipeline.Then(Double);
+        RequireDoubled(pipeline.Run(MakeInputs(50)), 50);
+    }
+
+    SECTION("More workers than inputs") {
+        easy::Pipeline pipeline(&prototype, 8);
+        pipeline.Then(Double);
+        RequireDoubled(pipeline.Run(MakeInputs(3)), 3);
+    }
+}
+
+TEST_CASE("Pipeline reused message does not leak fields", "[Pipeline]") {
+
+    Simple prototype;
+    easy::Pipeline pipeline(&prototype, 1);
+
+    std::vector<std::string> inputs;
+    for (size_t i = 0; i < 10; ++i) {
+        Simple simple;
+        simple.set_int_(static_cast<int32_t>(i));
+        if (i % 2 == 0) {
+            simple.set_str("even");
+            simple.mutable_embedded()->set_str("even");
+        }
+        inputs.push_back(simple.SerializeAsString());
+    }
+
+    auto outputs = pipeline.Run(inputs);
+
+    for (size_t i = 0; i < outputs.size(); ++i) {
+        Simple simple;
+        CHECK(simple.ParseFromString(outputs[i]));
+        CHECK(simple.int_() == static_cast<int32_t>(i));
+        CHECK(simple.has_embedded() == (i % 2 == 0));
+        REQUIRE(simple.str() == (i % 2 == 0 ? "even" : ""));
+    }
+}
+
+TEST_CASE("Pipeline balances uneven messages", "[Pipeline]") {
+
+    constexpr size_t count = 200;
+    std::vector<std::thread::id> owners(count);
+
+    std::mutex mutex;
+    std::condition_variable progress;
+    size_t processed = 0;
+    bool released = false;
+
+    // The first input blocks its worker until every input it did not claim has been processed elsewhere.
+    // A fixed split would keep half of the batch behind it, so the wait would time out instead.
+    Simple prototype;
+    easy::Pipeline pipeline(&prototype, 2);
+    pipeline.Then([&](easy::Reflection& reflection) {
+        const auto index = static_cast<size_t>(static_cast<int32_t>(reflection.At("int")));
+        owners[index] = std::this_thread::get_id();
+
+        std::unique_lock<std::mutex> lock(mutex);
+        if (index == 0) {
+            released = progress.wait_for(lock, std::chrono::seconds(10), [&]() { return processed >= count - 4; });
+        }
+        else {
+            ++processed;
+            progress.notify_all();
+        }
+    });
+
+    pipeline.Run(MakeInputs(count));
+
+    CHECK(released);
+    auto slow = std::count(owners.begin(), owners.end(), owners[0]);
+    REQUIRE(slow < static_cast<long>(count / 2));
+}
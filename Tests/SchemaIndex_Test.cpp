@@ -0,0 +1,127 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <protos/simple.pb.h>
+
+#include <ProtoReflection/H/Reflection.h>
+#include <ProtoReflection/H/SchemaIndex.h>
+
+TEST_CASE("SchemaIndex indexes nested paths", "[SchemaIndex]") {
+
+    easy::SchemaIndex index(Simple::descriptor());
+
+    SECTION("First level field") {
+        REQUIRE(index.Contains("str"));
+        REQUIRE(index.Find("str").size() == 1);
+    }
+
+    SECTION("Second level field") {
+        REQUIRE(index.Contains("embedded.str"));
+        const auto path = index.Find("embedded.str");
+        CHECK(path.size() == 2);
+        REQUIRE(path.back() == Simple::Level2::descriptor()->FindFieldByName("str"));
+    }
+
+    SECTION("Nested type lookup") {
+        REQUIRE(index.Contains(Simple::Level2::descriptor()));
+        REQUIRE(index.Contains(Simple::Level2::descriptor(), "str"));
+    }
+
+    SECTION("Path through a repeated field") {
+        REQUIRE_FALSE(index.Contains("integers.str"));
+    }
+
+    SECTION("Unknown field") {
+        REQUIRE_FALSE(index.Contains("embedded.int"));
+        REQUIRE_THROWS_AS(index.Find("embedded.int"), std::out_of_range);
+    }
+
+    SECTION("Message type outside the index") {
+        REQUIRE_FALSE(index.Contains(Node::descriptor(), "value"));
+        REQUIRE_THROWS_AS(index.Find(Node::descriptor(), "value"), std::out_of_range);
+    }
+}
+
+TEST_CASE("Reflection resolves paths through a SchemaIndex", "[SchemaIndex]") {
+
+    int integer_expected = 10;
+    std::string string_embedded_expected = "expected x2 ;)";
+
+    Simple simple;
+    simple.set_int_(integer_expected);
+    simple.mutable_embedded()->set_str(string_embedded_expected);
+
+    easy::SchemaIndex index(Simple::descriptor());
+    easy::Reflection reflection(&simple);
+
+    SECTION("First level int") {
+        int32_t value = reflection.At(index, "int");
+        REQUIRE(value == integer_expected);
+    }
+
+    SECTION("Second level string") {
+        std::string value = reflection.At(index, "embedded.str");
+        REQUIRE(value == string_embedded_expected);
+    }
+
+    SECTION("Second level string assigned") {
+        reflection.At(index, "embedded.str") = std::string("assigned");
+        REQUIRE(simple.embedded().str() == "assigned");
+    }
+
+    SECTION("Index of another message") {
+        easy::SchemaIndex other(Simple::Level2::descriptor());
+        auto e = [&]() { reflection.At(other, "str"); };
+        REQUIRE_THROWS_AS(e(), std::bad_typeid);
+    }
+
+    SECTION("TypeWrapper relative path") {
+        std::string value = reflection.At("embedded").At(index, "str");
+        REQUIRE(value == string_embedded_expected);
+    }
+
+    SECTION("Path resolved once") {
+        const auto path = index.Find("embedded.str");
+        std::string value = reflection.At(path);
+        REQUIRE(value == string_embedded_expected);
+
+        reflection.At(path) = std::string("assigned");
+        REQUIRE(simple.embedded().str() == "assigned");
+    }
+
+    SECTION("TypeWrapper relative path resolved once") {
+        const auto path = index.Find(Simple::Level2::descriptor(), "str");
+        std::string value = reflection.At("embedded").At(path);
+        REQUIRE(value == string_embedded_expected);
+    }
+
+    SECTION("Path of another message") {
+        const auto path = index.Find(Simple::Level2::descriptor(), "str");
+        auto e = [&]() { reflection.At(path); };
+        REQUIRE_THROWS_AS(e(), std::bad_typeid);
+    }
+
+    SECTION("Empty path") {
+        auto e = [&]() { reflection.At(easy::SchemaIndex::Path()); };
+        REQUIRE_THROWS_AS(e(), std::bad_typeid);
+    }
+}
+
+TEST_CASE("SchemaIndex resolves recursive types at any depth", "[SchemaIndex]") {
+
+    Node node;
+    node.mutable_child()->mutable_child()->mutable_child()->set_value(7);
+
+    easy::SchemaIndex index(Node::descriptor());
+    easy::Reflection reflection(&node);
+
+    SECTION("Deep path") {
+        REQUIRE(index.Find("child.child.child.value").size() == 4);
+        int32_t value = reflection.At(index, "child.child.child.value");
+        REQUIRE(value == 7);
+    }
+
+    SECTION("Deeper than the message") {
+        reflection.At(index, "child.child.child.child.child.value") = 9;
+        REQUIRE(node.child().child().child().child().child().value() == 9);
+    }
+}
@@ -1,2 +1,3 @@
 find_package(protobuf REQUIRED)
-find_package(Catch2 REQUIRED)
\ No newline at end of file
+find_package(Catch2 REQUIRED)
+find_package(Threads REQUIRED)
\ No newline at end of file